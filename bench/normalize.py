@@ -0,0 +1,145 @@
+#!/usr/bin/env python3
+"""Convert JMH / BenchmarkDotNet JSON reports into the common format in schema.json.
+
+    normalize.py jmh  RUNTIME REPORT.json [REPORT.json ...]
+    normalize.py bdn  RUNTIME REPORT-full.json [...]
+
+The normalized document is written to stdout. kotlinx-benchmark writes JMH-format
+reports, so the Kotlin suite goes through the jmh reader as well.
+"""
+import json
+import re
+import sys
+
+# JMH scoreUnit time part -> nanoseconds.
+NS_PER_UNIT = {"ns": 1, "us": 1e3, "ms": 1e6, "s": 1e9, "min": 60e9}
+
+
+def method_name(name):
+    """Last dotted component, with the first letter lowered ("Println" -> "println")."""
+    name = name.rsplit(".", 1)[-1]
+    return name[:1].lower() + name[1:]
+
+
+def percentile(values, p):
+    """Percentile by linear interpolation between ranks, at rank (n - 1) * p / 100."""
+    if not values:
+        return None
+    values = sorted(values)
+    k = (len(values) - 1) * p / 100.0
+    lo = int(k)
+    hi = min(lo + 1, len(values) - 1)
+    return values[lo] + (values[hi] - values[lo]) * (k - lo)
+
+
+def to_ns_per_op(score, unit):
+    """Converts a JMH time-per-op score ("us/op") to nanoseconds."""
+    return score * NS_PER_UNIT[unit.split("/")[0]]
+
+
+def to_ops_per_second(score, unit):
+    """Converts a JMH throughput score ("ops/ms") to ops per second."""
+    return score * 1e9 / NS_PER_UNIT[unit.split("/")[1]]
+
+
+def jmh_alloc(entry):
+    for key, metric in entry.get("secondaryMetrics", {}).items():
+        # JMH before 1.36 prefixes profiler metrics with a middle dot.
+        if key.lstrip("·") == "gc.alloc.rate.norm":
+            return metric["score"]
+    return None
+
+
+def read_jmh(reports):
+    merged = {}
+    for report in reports:
+        for entry in report:
+            params = {k: str(v) for k, v in sorted(entry.get("params", {}).items())}
+            key = (method_name(entry["benchmark"]), tuple(params.items()))
+            result = merged.setdefault(key, {
+                "benchmark": key[0],
+                "params": params,
+                "opsPerSecond": None,
+                "latencyNs": {"p50": None, "p99": None},
+                "latencyBasis": None,  # stays None for throughput-only reports
+                "allocatedBytesPerOp": None,
+            })
+            metric = entry["primaryMetric"]
+            unit = metric["scoreUnit"]
+            mode = entry["mode"]
+            if mode == "thrpt":
+                result["opsPerSecond"] = to_ops_per_second(metric["score"], unit)
+            elif mode in ("sample", "avgt"):
+                # SampleTime percentiles are per call and win over avgt's per-iteration ones.
+                if result["latencyBasis"] != "invocation":
+                    pct = metric["scorePercentiles"]
+                    result["latencyNs"] = {
+                        "p50": to_ns_per_op(pct["50.0"], unit),
+                        "p99": to_ns_per_op(pct["99.0"], unit),
+                    }
+                    result["latencyBasis"] = "invocation" if mode == "sample" else "iteration"
+                if result["opsPerSecond"] is None and mode == "avgt":
+                    result["opsPerSecond"] = 1e9 / to_ns_per_op(metric["score"], unit)
+            alloc = jmh_alloc(entry)
+            if alloc is not None:
+                result["allocatedBytesPerOp"] = alloc
+    return list(merged.values())
+
+
+def bdn_params(benchmark):
+    # "Count=5&Threads=2" -> {"count": "5", "threads": "2"}. The full JSON report joins
+    # parameters with "&"; ", " (as in the summary table) is accepted as well.
+    params = {}
+    for pair in filter(None, (p.strip() for p in re.split("[&,]", benchmark.get("Parameters", "")))):
+        name, _, value = pair.partition("=")
+        params[method_name(name)] = value
+    return dict(sorted(params.items()))
+
+
+def bdn_iterations(benchmark):
+    """Per-op nanoseconds of each measured workload iteration."""
+    values = benchmark["Statistics"].get("OriginalValues")
+    if values:
+        return values
+    return [m["Nanoseconds"] / m["Operations"]
+            for m in benchmark.get("Measurements", [])
+            if m["IterationMode"] == "Workload" and m["IterationStage"] == "Result"]
+
+
+def read_bdn(reports):
+    results = []
+    for report in reports:
+        for benchmark in report["Benchmarks"]:
+            iterations = bdn_iterations(benchmark)
+            memory = benchmark.get("Memory") or {}
+            results.append({
+                "benchmark": method_name(benchmark["Method"]),
+                "params": bdn_params(benchmark),
+                "opsPerSecond": 1e9 / benchmark["Statistics"]["Mean"],
+                "latencyNs": {"p50": percentile(iterations, 50), "p99": percentile(iterations, 99)},
+                "latencyBasis": "iteration",
+                "allocatedBytesPerOp": memory.get("BytesAllocatedPerOperation"),
+            })
+    return results
+
+
+READERS = {"jmh": read_jmh, "bdn": read_bdn}
+
+
+def main(argv):
+    if len(argv) < 4 or argv[1] not in READERS:
+        sys.exit(__doc__)
+    source, runtime, paths = argv[1], argv[2], argv[3:]
+    reports = []
+    for path in paths:
+        with open(path, encoding="utf-8") as f:
+            reports.append(json.load(f))
+    results = READERS[source](reports)
+    results.sort(key=lambda r: (r["benchmark"], sorted(r["params"].items())))
+    json.dump({"schema": 1, "runtime": runtime, "source": source, "results": results},
+              sys.stdout, indent=2)
+    sys.stdout.write("\n")
+
+
+if __name__ == "__main__":
+    main(sys.argv)
@@ -0,0 +1,49 @@
+#!/bin/sh
+# Checks that every output mode prints exactly the bytes of the default mode, for line counts
+# around the 16K-line chunk and wave boundaries of --parallel. Build the samples as for
+# bench/syscalls.sh. Exits non-zero on the first mismatch, and also when a sample has not been
+# built, so that a partial run cannot pass for a full one.
+set -eu
+
+root=$(cd "$(dirname "$0")/.." && pwd)
+expected=$(mktemp)
+actual=$(mktemp)
+trap 'rm -f "$expected" "$actual"' EXIT
+missing=""
+
+# 16384 lines per chunk; a --threads 3 wave is 6 chunks = 98304 lines.
+counts="0 1 5 16383 16384 16385 98303 98304 98305 1000000"
+
+check() {
+    # $1 = sample, $2 = artifact that must exist, rest = command
+    sample=$1 artifact=$2
+    shift 2
+    if [ ! -e "$artifact" ]; then
+        echo "$sample: not built ($artifact missing)" >&2
+        missing="$missing $sample"
+        return
+    fi
+    for count in $counts; do
+        "$@" --count "$count" > "$expected"
+        for mode in --buffered --alloc-free "--parallel --threads 1" "--parallel --threads 3" --parallel; do
+            # $mode is split on purpose: "--parallel --threads 3" is two options.
+            "$@" --count "$count" $mode > "$actual"
+            if ! cmp -s "$expected" "$actual"; then
+                echo "$sample: $mode --count $count differs from the default mode" >&2
+                exit 1
+            fi
+        done
+    done
+    echo "$sample: all modes match for counts $counts"
+}
+
+kotlin_launcher="$root/kotlin/build/install/kotlin-sample/bin/kotlin-sample"
+csharp_dll="$root/csharp/bin/Release/net7.0/csharp.dll"
+check java "$root/java/target/classes/Main.class" java -cp "$root/java/target/classes" Main
+check kotlin "$kotlin_launcher" "$kotlin_launcher"
+check csharp "$csharp_dll" dotnet "$csharp_dll"
+
+if [ -n "$missing" ]; then
+    echo "not checked:$missing" >&2
+    exit 1
+fi
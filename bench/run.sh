@@ -0,0 +1,29 @@
+#!/bin/sh
+# Runs the Java, Kotlin and C# benchmark suites and writes one normalized result file
+# per runtime to bench/results/.
+set -eu
+
+root=$(cd "$(dirname "$0")/.." && pwd)
+results="$root/bench/results"
+mkdir -p "$results"
+
+echo "== java (JMH)"
+(cd "$root/java" && mvn -q -DskipTests package)
+# ParallelLinesBenchmark needs the core count; bench/scaling.sh runs it.
+java -jar "$root/java/target/benchmarks.jar" -e ParallelLinesBenchmark -prof gc \
+    -rf json -rff "$results/java-jmh.json"
+"$root/bench/normalize.py" jmh java "$results/java-jmh.json" > "$results/java.json"
+
+echo "== kotlin (kotlinx-benchmark)"
+(cd "$root/kotlin" && gradle -q benchBenchmark benchLatencyBenchmark)
+"$root/bench/normalize.py" jmh kotlin \
+    "$(ls -td "$root"/kotlin/build/reports/benchmarks/main/*/ | head -1)"bench.json \
+    "$(ls -td "$root"/kotlin/build/reports/benchmarks/latency/*/ | head -1)"bench.json \
+    > "$results/kotlin.json"
+
+echo "== csharp (BenchmarkDotNet)"
+(cd "$root/csharp" && dotnet run -c Release -- --bench --filter '*')
+"$root/bench/normalize.py" bdn csharp \
+    "$root"/csharp/BenchmarkDotNet.Artifacts/results/*-report-full.json > "$results/csharp.json"
+
+echo "results in $results"
@@ -0,0 +1,47 @@
+#!/bin/sh
+# Thread-scaling curves for the --parallel writers. Runs ParallelLinesBenchmark on each
+# runtime for 1..N threads (N = number of cores), writes the normalized results to
+# bench/results/scaling-*.json and prints ops/s and speedup over one thread.
+set -eu
+
+root=$(cd "$(dirname "$0")/.." && pwd)
+results="$root/bench/results"
+mkdir -p "$results"
+
+echo "== java (JMH)"
+(cd "$root/java" && mvn -q -DskipTests package)
+java -jar "$root/java/target/benchmarks.jar" ParallelLinesBenchmark -bm thrpt \
+    -p threads="$(seq -s, 1 "$(nproc)")" -rf json -rff "$results/scaling-java-jmh.json"
+"$root/bench/normalize.py" jmh java "$results/scaling-java-jmh.json" > "$results/scaling-java.json"
+
+echo "== kotlin (kotlinx-benchmark)"
+(cd "$root/kotlin" && gradle -q benchScalingBenchmark)
+"$root/bench/normalize.py" jmh kotlin \
+    "$(ls -td "$root"/kotlin/build/reports/benchmarks/scaling/*/ | head -1)"bench.json \
+    > "$results/scaling-kotlin.json"
+
+echo "== csharp (BenchmarkDotNet)"
+(cd "$root/csharp" && dotnet run -c Release -- --bench --filter '*ParallelLinesBenchmark*')
+"$root/bench/normalize.py" bdn csharp \
+    "$root"/csharp/BenchmarkDotNet.Artifacts/results/*ParallelLinesBenchmark-report-full.json \
+    > "$results/scaling-csharp.json"
+
+python3 - "$results"/scaling-java.json "$results"/scaling-kotlin.json "$results"/scaling-csharp.json <<'PY'
+import json, sys
+
+curves = {}
+for path in sys.argv[1:]:
+    with open(path, encoding="utf-8") as f:
+        report = json.load(f)
+    curves[report["runtime"]] = {int(r["params"]["threads"]): r["opsPerSecond"]
+                                 for r in report["results"] if r["benchmark"] == "parallel"}
+
+print("threads" + "".join(f"{runtime + ' ops/s':>18}{'speedup':>9}" for runtime in curves))
+for threads in sorted({t for curve in curves.values() for t in curve}):
+    row = f"{threads:>7}"
+    for curve in curves.values():
+        ops, base = curve.get(threads), curve.get(1)
+        row += f"{ops:>18.1f}" if ops else f"{'-':>18}"
+        row += f"{ops / base:>9.2f}" if ops and base else f"{'-':>9}"
+    print(row)
+PY
@@ -0,0 +1,79 @@
+#!/usr/bin/env python3
+"""Cold-start wall time and peak RSS of every sample artifact.
+
+    startup.py [RUNS]
+
+Each artifact is launched RUNS times (default 20) as a fresh process with its output
+discarded; the table shows the median wall time and the largest peak RSS seen. Artifacts
+that have not been built are skipped. To build them all:
+
+    java/    mvn package && mvn -Pappcds package && mvn -Pnative package
+    kotlin/  gradle installDist appCdsArchive nativeCompile
+    csharp/  dotnet build -c Release
+             dotnet publish -c Release -r linux-x64 -p:StartupProfile=ReadyToRun -o publish/r2r
+             dotnet publish -c Release -r linux-x64 -p:StartupProfile=Aot -o publish/aot
+
+"Cold" means a new JVM/CLR per launch; the OS page cache is not dropped between runs.
+"""
+import os
+import statistics
+import subprocess
+import sys
+import time
+
+ROOT = os.path.dirname(os.path.dirname(os.path.abspath(__file__)))
+KOTLIN_LAUNCHER = "kotlin/build/install/kotlin-sample/bin/kotlin-sample"
+
+# (sample, variant, command, extra environment, files that must exist)
+ARTIFACTS = [
+    ("java", "jit", ["java", "-jar", "java/target/main.jar"], {},
+     ["java/target/main.jar"]),
+    ("java", "appcds", ["java", "-XX:SharedArchiveFile=java/target/main.jsa", "-jar", "java/target/main.jar"], {},
+     ["java/target/main.jar", "java/target/main.jsa"]),
+    ("java", "native", ["java/target/main"], {},
+     ["java/target/main"]),
+    ("kotlin", "jit", [KOTLIN_LAUNCHER], {},
+     [KOTLIN_LAUNCHER]),
+    ("kotlin", "appcds", [KOTLIN_LAUNCHER], {"JAVA_OPTS": "-XX:SharedArchiveFile=kotlin/build/cds/main.jsa"},
+     [KOTLIN_LAUNCHER, "kotlin/build/cds/main.jsa"]),
+    ("kotlin", "native", ["kotlin/build/native/nativeCompile/kotlin-sample"], {},
+     ["kotlin/build/native/nativeCompile/kotlin-sample"]),
+    # The apphost, not `dotnet csharp.dll`, so that all three C# rows start the same way.
+    ("csharp", "jit", ["csharp/bin/Release/net7.0/csharp"], {},
+     ["csharp/bin/Release/net7.0/csharp"]),
+    ("csharp", "r2r", ["csharp/publish/r2r/csharp"], {},
+     ["csharp/publish/r2r/csharp"]),
+    ("csharp", "aot", ["csharp/publish/aot/csharp"], {},
+     ["csharp/publish/aot/csharp"]),
+]
+
+
+def launch(command, env):
+    """Runs command once; returns (wall seconds, peak RSS in KiB)."""
+    start = time.perf_counter()
+    process = subprocess.Popen(command, cwd=ROOT, env=env, stdout=subprocess.DEVNULL)
+    _, status, rusage = os.wait4(process.pid, 0)
+    wall = time.perf_counter() - start
+    process.returncode = os.waitstatus_to_exitcode(status)
+    if process.returncode != 0:
+        raise subprocess.CalledProcessError(process.returncode, command)
+    # ru_maxrss is in KiB on Linux.
+    return wall, rusage.ru_maxrss
+
+
+def main(argv):
+    runs = int(argv[1]) if len(argv) > 1 else 20
+    print(f"{'sample':<8} {'variant':<8} {'median ms':>10} {'peak RSS MiB':>13}")
+    for sample, variant, command, extra_env, required in ARTIFACTS:
+        if not all(os.path.exists(os.path.join(ROOT, path)) for path in required):
+            print(f"{sample:<8} {variant:<8} {'not built':>10}")
+            continue
+        env = dict(os.environ, **extra_env)
+        samples = [launch(command, env) for _ in range(runs)]
+        wall = statistics.median(s[0] for s in samples)
+        rss = max(s[1] for s in samples)
+        print(f"{sample:<8} {variant:<8} {wall * 1000:>10.1f} {rss / 1024:>13.1f}")
+
+
+if __name__ == "__main__":
+    main(sys.argv)
@@ -0,0 +1,32 @@
+#!/bin/sh
+# Compares the default one-line-per-call output with --buffered for each sample: number
+# of write syscalls and wall time, printing COUNT lines (default 1000000). The writes are
+# counted under `strace -c`; the time comes from a separate run without strace, because
+# tracing stops the process on every syscall and would slow the println run the most.
+# Expects the samples to be built: `mvn package` in java/, `gradle installDist` in
+# kotlin/ and `dotnet build -c Release` in csharp/.
+set -eu
+
+root=$(cd "$(dirname "$0")/.." && pwd)
+count=${1:-1000000}
+
+run() {
+    # $1 = label, $2 = mode flag (may be empty), rest = command
+    label=$1 mode=$2
+    shift 2
+    trace=$(mktemp)
+    strace -f -c -e trace=write -o "$trace" "$@" --count "$count" $mode > /dev/null
+    start=$(date +%s.%N)
+    "$@" --count "$count" $mode > /dev/null
+    end=$(date +%s.%N)
+    writes=$(awk '$NF == "write" { print $4 }' "$trace")
+    rm -f "$trace"
+    printf '%-8s %-10s %10s %8.3f\n' "$label" "${mode:---println}" "${writes:-0}" "$(awk "BEGIN { print $end - $start }")"
+}
+
+printf '%-8s %-10s %10s %8s\n' sample mode writes seconds
+for mode in "" --buffered; do
+    run java "$mode" java -cp "$root/java/target/classes" Main
+    run kotlin "$mode" "$root/kotlin/build/install/kotlin-sample/bin/kotlin-sample"
+    run csharp "$mode" dotnet "$root/csharp/bin/Release/net7.0/csharp.dll"
+done
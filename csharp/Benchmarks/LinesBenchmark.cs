@@ -0,0 +1,53 @@
+using BenchmarkDotNet.Attributes;
+
+namespace Benchmarks;
+
+/// <summary>
+/// BenchmarkDotNet suite for <see cref="Lines"/>. <see cref="Println"/> writes through a writer
+/// with <see cref="StreamWriter.AutoFlush"/> on, which is how <see cref="Console.Out"/> is set up.
+/// <see cref="MemoryDiagnoserAttribute"/> should report no allocation for <see cref="AllocFree"/>.
+/// </summary>
+[MemoryDiagnoser]
+[JsonExporterAttribute.Full]
+public class LinesBenchmark
+{
+    internal static readonly string NullDevice = OperatingSystem.IsWindows() ? "NUL" : "/dev/null";
+
+    private StreamWriter _output = null!;
+    private StreamWriter _bufferedOutput = null!;
+
+    [Params(5, 1_000_000)]
+    public int Count { get; set; }
+
+    [GlobalSetup]
+    public void OpenSink()
+    {
+        _output = new StreamWriter(File.OpenWrite(NullDevice)) { AutoFlush = true };
+        _bufferedOutput = new StreamWriter(File.OpenWrite(NullDevice), bufferSize: 1 << 16);
+    }
+
+    [GlobalCleanup]
+    public void CloseSink()
+    {
+        _output.Dispose();
+        _bufferedOutput.Dispose();
+    }
+
+    [Benchmark]
+    public void Println()
+    {
+        Lines.WriteLines(_output, Count);
+    }
+
+    [Benchmark]
+    public void Buffered()
+    {
+        Lines.WriteLinesBuffered(_bufferedOutput, Count);
+    }
+
+    [Benchmark]
+    public void AllocFree()
+    {
+        Lines.WriteLinesAllocFree(_bufferedOutput, Count);
+    }
+}
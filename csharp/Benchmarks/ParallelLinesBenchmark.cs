@@ -0,0 +1,43 @@
+using BenchmarkDotNet.Attributes;
+
+namespace Benchmarks;
+
+/// <summary>
+/// BenchmarkDotNet suite for <see cref="ParallelLineWriter"/>, for thread-scaling curves: it runs
+/// once for every thread count from 1 to the number of cores. Compare with
+/// <see cref="LinesBenchmark.AllocFree"/>, its sequential counterpart.
+/// </summary>
+[MemoryDiagnoser]
+[JsonExporterAttribute.Full]
+public class ParallelLinesBenchmark
+{
+    private Stream _output = null!;
+    private ParallelLineWriter _writer = null!;
+
+    [Params(1_000_000)]
+    public int Count { get; set; }
+
+    [ParamsSource(nameof(ThreadCounts))]
+    public int Threads { get; set; }
+
+    public static IEnumerable<int> ThreadCounts => Enumerable.Range(1, Environment.ProcessorCount);
+
+    [GlobalSetup]
+    public void OpenSink()
+    {
+        _output = File.OpenWrite(LinesBenchmark.NullDevice);
+        _writer = new ParallelLineWriter(_output, Threads);
+    }
+
+    [GlobalCleanup]
+    public void CloseSink()
+    {
+        _output.Dispose();
+    }
+
+    [Benchmark]
+    public void Parallel()
+    {
+        _writer.WriteLines(Count);
+    }
+}
@@ -0,0 +1,75 @@
+using System.Text;
+
+/// <summary>
+/// The sample loop, kept apart from <c>Program.cs</c> so it can be benchmarked against any writer.
+/// It prints the same <c>"i = 1"</c> .. <c>"i = count"</c> lines as the Java and Kotlin samples.
+/// </summary>
+public static class Lines
+{
+    /// <summary>Number of chars <see cref="WriteLinesBuffered"/> collects before handing them to the writer.</summary>
+    private const int BatchChars = 8192;
+
+    /// <summary>Room for <c>"i = "</c>, the digits of <see cref="int.MinValue"/> and a CRLF.</summary>
+    private const int MaxLineChars = 32;
+
+    /// <summary>Writes one line per <see cref="TextWriter.WriteLine(string)"/> call.</summary>
+    public static void WriteLines(TextWriter output, int count)
+    {
+        // A long index, so that the loop still ends when count is int.MaxValue.
+        for (var i = 1L; i <= count; i++)
+        {
+            output.WriteLine("i = " + i);
+        }
+    }
+
+    /// <summary>
+    /// Writes the same lines as <see cref="WriteLines"/>, but collects them in one reused
+    /// <see cref="StringBuilder"/> and hands it to <paramref name="output"/> in
+    /// <see cref="BatchChars"/>-char batches, flushing once at the end. <paramref name="output"/>
+    /// is meant to be a long-lived writer with <see cref="StreamWriter.AutoFlush"/> off.
+    /// </summary>
+    public static void WriteLinesBuffered(TextWriter output, int count)
+    {
+        var batch = new StringBuilder(BatchChars + 32);
+        for (var i = 1L; i <= count; i++)
+        {
+            batch.Append("i = ").Append(i).AppendLine();
+            if (batch.Length >= BatchChars)
+            {
+                output.Write(batch);
+                batch.Clear();
+            }
+        }
+
+        output.Write(batch);
+        output.Flush();
+    }
+
+    /// <summary>
+    /// Writes the same lines as <see cref="WriteLines"/> without allocating: each line is
+    /// assembled in a stack buffer, the number through <see cref="long.TryFormat"/>, and handed
+    /// to <paramref name="output"/> as a span. <paramref name="output"/> is meant to be a
+    /// long-lived writer with <see cref="StreamWriter.AutoFlush"/> off.
+    /// </summary>
+    /// <remarks>
+    /// <c>line.TryWrite($"i = {i}")</c> reads better, but on net7.0 the handler still boxes the
+    /// <c>long</c> index once tiered compilation has run (24 bytes a line), so the pieces are
+    /// copied in by hand.
+    /// </remarks>
+    public static void WriteLinesAllocFree(TextWriter output, int count)
+    {
+        const string prefix = "i = ";
+        Span<char> line = stackalloc char[MaxLineChars];
+        var newline = output.NewLine.AsSpan();
+        prefix.CopyTo(line);
+        for (var i = 1L; i <= count; i++)
+        {
+            i.TryFormat(line[prefix.Length..], out var digits);
+            var length = prefix.Length + digits;
+            newline.CopyTo(line[length..]);
+            output.Write(line[..(length + newline.Length)]);
+        }
+
+        output.Flush();
+    }
+}
@@ -0,0 +1,155 @@
+using System.Buffers.Text;
+using System.Numerics;
+using System.Text;
+
+/// <summary>
+/// Writes the same lines as <see cref="Lines.WriteLines"/> as ASCII bytes, formatting chunks of
+/// the range with <see cref="Parallel.For(int, int, ParallelOptions, Action{int})"/> (see
+/// "Parallel output" in the README).
+/// </summary>
+/// <remarks>
+/// Within a chunk, the digits of <see cref="Vector{T}.Count"/> consecutive numbers are computed
+/// together in one <see cref="Vector{T}"/>.
+/// </remarks>
+public sealed class ParallelLineWriter
+{
+    public const int ChunkLines = 16 * 1024;
+    private const int ChunksPerThread = 2;
+
+    private const int MaxDigits = 10;
+
+    private static readonly byte[] Prefix = "i = "u8.ToArray();
+
+    private readonly Stream _output;
+    private readonly ParallelOptions _options;
+    private readonly byte[] _newline;
+    private readonly byte[][] _chunks;
+    private readonly int[] _lengths;
+
+    public ParallelLineWriter(Stream output, int threads)
+    {
+        if (threads < 1)
+        {
+            throw new ArgumentOutOfRangeException(nameof(threads), threads, "threads must be at least 1");
+        }
+
+        _output = output;
+        _options = new ParallelOptions { MaxDegreeOfParallelism = threads };
+        _newline = Encoding.ASCII.GetBytes(Environment.NewLine);
+        var maxLineBytes = Prefix.Length + MaxDigits + _newline.Length;
+        _chunks = new byte[threads * ChunksPerThread][];
+        for (var c = 0; c < _chunks.Length; c++)
+        {
+            _chunks[c] = new byte[ChunkLines * maxLineBytes];
+        }
+
+        _lengths = new int[_chunks.Length];
+    }
+
+    /// <summary>Writes <c>"i = 1"</c> .. <c>"i = count"</c> and flushes the underlying stream.</summary>
+    public void WriteLines(int count)
+    {
+        for (long waveStart = 1; waveStart <= count; waveStart += (long)_chunks.Length * ChunkLines)
+        {
+            var first = (int)waveStart;
+            var used = (int)Math.Min(_chunks.Length, (count - waveStart) / ChunkLines + 1);
+            Parallel.For(0, used, _options, c =>
+            {
+                var from = first + c * ChunkLines;
+                var to = (int)Math.Min(count, (long)from + ChunkLines - 1);
+                _lengths[c] = FormatChunk(_chunks[c], from, to);
+            });
+            for (var c = 0; c < used; c++)
+            {
+                _output.Write(_chunks[c], 0, _lengths[c]);
+            }
+        }
+
+        _output.Flush();
+    }
+
+    private int FormatChunk(Span<byte> chunk, int from, int to)
+    {
+        var width = Vector<int>.Count;
+        // digits[row * width + lane] is the row-th digit from the right of lane's number.
+        Span<int> digits = stackalloc int[MaxDigits * width];
+        Span<int> lengths = stackalloc int[width];
+        Span<int> lanes = stackalloc int[width];
+        for (var lane = 0; lane < width; lane++)
+        {
+            lanes[lane] = lane;
+        }
+
+        var offsets = new Vector<int>(lanes);
+        var length = 0;
+        // A long index, so that neither loop wraps when to is int.MaxValue.
+        long i = from;
+        for (; to - i >= width - 1; i += width)
+        {
+            var value = new Vector<int>((int)i) + offsets;
+            var digitCount = Vector<int>.One;
+            for (var row = 0; ; row++)
+            {
+                value = DivRem10(value, out var remainder);
+                remainder.CopyTo(digits[(row * width)..]);
+                if (value == Vector<int>.Zero)
+                {
+                    break;
+                }
+
+                // GreaterThan is -1 in the lanes that still have digits left.
+                digitCount -= Vector.GreaterThan(value, Vector<int>.Zero);
+            }
+
+            digitCount.CopyTo(lengths);
+            for (var lane = 0; lane < width; lane++)
+            {
+                Prefix.CopyTo(chunk[length..]);
+                length += Prefix.Length;
+                for (var row = lengths[lane] - 1; row >= 0; row--)
+                {
+                    chunk[length++] = (byte)('0' + digits[row * width + lane]);
+                }
+
+                _newline.CopyTo(chunk[length..]);
+                length += _newline.Length;
+            }
+        }
+
+        for (; i <= to; i++)
+        {
+            Prefix.CopyTo(chunk[length..]);
+            length += Prefix.Length;
+            Utf8Formatter.TryFormat(i, chunk[length..], out var written);
+            length += written;
+            _newline.CopyTo(chunk[length..]);
+            length += _newline.Length;
+        }
+
+        return length;
+    }
+
+    /// <summary>
+    /// Divides each lane of non-negative <paramref name="value"/> by 10. There is no SIMD integer
+    /// division, so the quotient is estimated in single precision and corrected with integer
+    /// multiplies. The first estimate is off by at most a few dozen; refining it on the (small)
+    /// remainder leaves it off by at most one, which the last step fixes. Any wrap-around in
+    /// <c>q * 10</c> cancels out because the true remainder fits in an int.
+    /// </summary>
+    private static Vector<int> DivRem10(Vector<int> value, out Vector<int> remainder)
+    {
+        var ten = new Vector<int>(10);
+        var tenth = new Vector<float>(0.1f);
+        var quotient = Vector.ConvertToInt32(Vector.ConvertToSingle(value) * tenth);
+        remainder = value - quotient * ten;
+        quotient += Vector.ConvertToInt32(Vector.ConvertToSingle(remainder) * tenth);
+        remainder = value - quotient * ten;
+
+        // Comparison masks are -1 where true.
+        var low = Vector.LessThan(remainder, Vector<int>.Zero);
+        var high = Vector.GreaterThanOrEqual(remainder, ten);
+        quotient += low - high;
+        remainder += (high - low) * ten;
+        return quotient;
+    }
+}
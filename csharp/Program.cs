@@ -1,2 +1,79 @@
 ﻿// See https://aka.ms/new-console-template for more information
+// Options:
+//   --count N     print N lines instead of 5
+//   --buffered    batch the lines and flush once instead of one Console.WriteLine per line
+//   --alloc-free  like --buffered, but format each line into a stack buffer without allocating
+//   --parallel    format chunks of lines with Parallel.For and Vector<T>, and write them in order
+//   --threads N   threads for --parallel, at least 1; defaults to the number of cores
+//   --bench ...   run the BenchmarkDotNet suites; the remaining arguments go to BenchmarkSwitcher
+//                 (not available in the Native AOT build)
+#if !NATIVE_AOT
+using BenchmarkDotNet.Running;
+
+if (args.Length > 0 && args[0] == "--bench")
+{
+    BenchmarkSwitcher.FromAssembly(typeof(Program).Assembly).Run(args[1..]);
+    return;
+}
+#endif
+
+var count = 5;
+var output = Output.WriteLine;
+var threads = Environment.ProcessorCount;
+for (var a = 0; a < args.Length; a++)
+{
+    switch (args[a])
+    {
+        case "--count":
+            count = int.Parse(args[++a]);
+            break;
+        case "--buffered":
+            output = Output.Buffered;
+            break;
+        case "--alloc-free":
+            output = Output.AllocFree;
+            break;
+        case "--parallel":
+            output = Output.Parallel;
+            break;
+        case "--threads":
+            threads = int.Parse(args[++a]);
+            break;
+        default:
+            throw new ArgumentException($"Unknown option: {args[a]}");
+    }
+}
+
 Console.WriteLine("Hello, World!");
+switch (output)
+{
+    case Output.WriteLine:
+        Lines.WriteLines(Console.Out, count);
+        break;
+    case Output.Buffered:
+    {
+        using var stdout = new StreamWriter(Console.OpenStandardOutput(), bufferSize: 1 << 16);
+        Lines.WriteLinesBuffered(stdout, count);
+        break;
+    }
+    case Output.AllocFree:
+    {
+        using var stdout = new StreamWriter(Console.OpenStandardOutput(), bufferSize: 1 << 16);
+        Lines.WriteLinesAllocFree(stdout, count);
+        break;
+    }
+    case Output.Parallel:
+    {
+        using var stdout = Console.OpenStandardOutput();
+        new ParallelLineWriter(stdout, threads).WriteLines(count);
+        break;
+    }
+}
+
+internal enum Output
+{
+    WriteLine,
+    Buffered,
+    AllocFree,
+    Parallel,
+}
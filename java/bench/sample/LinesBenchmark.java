@@ -0,0 +1,80 @@
+package sample;
+
+import org.openjdk.jmh.annotations.Benchmark;
+import org.openjdk.jmh.annotations.BenchmarkMode;
+import org.openjdk.jmh.annotations.Fork;
+import org.openjdk.jmh.annotations.Level;
+import org.openjdk.jmh.annotations.Measurement;
+import org.openjdk.jmh.annotations.Mode;
+import org.openjdk.jmh.annotations.OutputTimeUnit;
+import org.openjdk.jmh.annotations.Param;
+import org.openjdk.jmh.annotations.Scope;
+import org.openjdk.jmh.annotations.Setup;
+import org.openjdk.jmh.annotations.State;
+import org.openjdk.jmh.annotations.TearDown;
+import org.openjdk.jmh.annotations.Warmup;
+
+import java.io.FileNotFoundException;
+import java.io.FileOutputStream;
+import java.io.IOException;
+import java.io.OutputStreamWriter;
+import java.io.PrintStream;
+import java.io.Writer;
+import java.util.concurrent.TimeUnit;
+
+/**
+ * JMH benchmarks for {@link Lines}. The println case writes through an autoflushing
+ * {@link PrintStream}, which is how {@code System.out} is set up.
+ *
+ * <p>{@link #allocFree} creates its writer and buffer once per trial, so its loop is meant to
+ * allocate nothing. Check that with {@code java -jar target/benchmarks.jar
+ * LinesBenchmark.allocFree -prof gc} and read {@code gc.alloc.rate.norm}.
+ */
+@State(Scope.Thread)
+@BenchmarkMode({Mode.Throughput, Mode.SampleTime})
+@OutputTimeUnit(TimeUnit.NANOSECONDS)
+@Warmup(iterations = 5, time = 1)
+@Measurement(iterations = 5, time = 1)
+@Fork(1)
+public class LinesBenchmark {
+    static final String NULL_DEVICE =
+            System.getProperty("os.name").startsWith("Windows") ? "NUL" : "/dev/null";
+
+    @Param({"5", "1000000"})
+    public int count;
+
+    private PrintStream out;
+    private Writer writer;
+    private FileOutputStream asciiOut;
+    private AsciiLineWriter asciiWriter;
+
+    @Setup(Level.Trial)
+    public void openSink() throws FileNotFoundException {
+        out = new PrintStream(new FileOutputStream(NULL_DEVICE), true);
+        writer = new OutputStreamWriter(new FileOutputStream(NULL_DEVICE));
+        asciiOut = new FileOutputStream(NULL_DEVICE);
+        asciiWriter = new AsciiLineWriter(asciiOut, 1 << 16);
+    }
+
+    @TearDown(Level.Trial)
+    public void closeSink() throws IOException {
+        out.close();
+        writer.close();
+        asciiOut.close();
+    }
+
+    @Benchmark
+    public void println() {
+        Lines.println(out, count);
+    }
+
+    @Benchmark
+    public void buffered() throws IOException {
+        Lines.buffered(writer, count);
+    }
+
+    @Benchmark
+    public void allocFree() throws IOException {
+        asciiWriter.writeLines(count);
+    }
+}
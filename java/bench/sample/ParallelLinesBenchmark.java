@@ -0,0 +1,62 @@
+package sample;
+
+import org.openjdk.jmh.annotations.Benchmark;
+import org.openjdk.jmh.annotations.BenchmarkMode;
+import org.openjdk.jmh.annotations.Fork;
+import org.openjdk.jmh.annotations.Level;
+import org.openjdk.jmh.annotations.Measurement;
+import org.openjdk.jmh.annotations.Mode;
+import org.openjdk.jmh.annotations.OutputTimeUnit;
+import org.openjdk.jmh.annotations.Param;
+import org.openjdk.jmh.annotations.Scope;
+import org.openjdk.jmh.annotations.Setup;
+import org.openjdk.jmh.annotations.State;
+import org.openjdk.jmh.annotations.TearDown;
+import org.openjdk.jmh.annotations.Warmup;
+
+import java.io.FileNotFoundException;
+import java.io.FileOutputStream;
+import java.io.IOException;
+import java.util.concurrent.TimeUnit;
+
+/**
+ * JMH benchmark for {@link ParallelLineWriter}, for thread-scaling curves. Compare with
+ * {@code LinesBenchmark.allocFree}, its sequential counterpart.
+ *
+ * <p>JMH cannot derive {@code @Param} values from the machine, so {@code threads} defaults
+ * to 1 and {@code bench/run.sh} leaves this class out. {@code bench/scaling.sh} runs it with
+ * {@code -p threads=1,2,...,N} for the number of cores N.
+ */
+@State(Scope.Thread)
+@BenchmarkMode({Mode.Throughput, Mode.SampleTime})
+@OutputTimeUnit(TimeUnit.NANOSECONDS)
+@Warmup(iterations = 5, time = 1)
+@Measurement(iterations = 5, time = 1)
+@Fork(1)
+public class ParallelLinesBenchmark {
+    @Param({"1000000"})
+    public int count;
+
+    @Param({"1"})
+    public int threads;
+
+    private FileOutputStream out;
+    private ParallelLineWriter writer;
+
+    @Setup(Level.Trial)
+    public void openSink() throws FileNotFoundException {
+        out = new FileOutputStream(LinesBenchmark.NULL_DEVICE);
+        writer = new ParallelLineWriter(out, threads);
+    }
+
+    @TearDown(Level.Trial)
+    public void closeSink() throws IOException {
+        writer.close();
+        out.close();
+    }
+
+    @Benchmark
+    public void parallel() throws IOException {
+        writer.writeLines(count);
+    }
+}
@@ -1,15 +1,57 @@
+import sample.AsciiLineWriter;
+import sample.Lines;
+import sample.ParallelLineWriter;
+
+import java.io.IOException;
+import java.io.OutputStreamWriter;
+
 //TIP To <b>Run</b> code, press <shortcut actionId="Run"/> or
 // click the <icon src="AllIcons.Actions.Execute"/> icon in the gutter.
 public class Main {
-    public static void main(String[] args) {
+    private enum Output { PRINTLN, BUFFERED, ALLOC_FREE, PARALLEL }
+
+    /**
+     * Options:
+     * <ul>
+     *   <li>{@code --count N}: print {@code N} lines instead of 5.</li>
+     *   <li>{@code --buffered}: batch the lines and flush once instead of one {@code println} per line.</li>
+     *   <li>{@code --alloc-free}: like {@code --buffered}, but format the lines as bytes without
+     *       allocating a String per line.</li>
+     *   <li>{@code --parallel}: like {@code --alloc-free}, but format chunks of lines on several
+     *       threads and write them in order.</li>
+     *   <li>{@code --threads N}: threads for {@code --parallel}, at least 1; defaults to the number of cores.</li>
+     * </ul>
+     */
+    public static void main(String[] args) throws IOException {
+        int count = 5;
+        Output output = Output.PRINTLN;
+        int threads = Runtime.getRuntime().availableProcessors();
+        for (int a = 0; a < args.length; a++) {
+            switch (args[a]) {
+                case "--count" -> count = Integer.parseInt(args[++a]);
+                case "--buffered" -> output = Output.BUFFERED;
+                case "--alloc-free" -> output = Output.ALLOC_FREE;
+                case "--parallel" -> output = Output.PARALLEL;
+                case "--threads" -> threads = Integer.parseInt(args[++a]);
+                default -> throw new IllegalArgumentException("Unknown option: " + args[a]);
+            }
+        }
+
         //TIP Press <shortcut actionId="ShowIntentionActions"/> with your caret at the highlighted text
         // to see how IntelliJ IDEA suggests fixing it.
         System.out.printf("Hello and welcome!");
 
-        for (int i = 1; i <= 5; i++) {
-            //TIP Press <shortcut actionId="Debug"/> to start debugging your code. We have set one <icon src="AllIcons.Debugger.Db_set_breakpoint"/> breakpoint
-            // for you, but you can always add more by pressing <shortcut actionId="ToggleLineBreakpoint"/>.
-            System.out.println("i = " + i);
+        //TIP Press <shortcut actionId="Debug"/> to start debugging your code. We have set one <icon src="AllIcons.Debugger.Db_set_breakpoint"/> breakpoint
+        // for you, but you can always add more by pressing <shortcut actionId="ToggleLineBreakpoint"/>.
+        switch (output) {
+            case PRINTLN -> Lines.println(System.out, count);
+            case BUFFERED -> Lines.buffered(new OutputStreamWriter(System.out), count);
+            case ALLOC_FREE -> new AsciiLineWriter(System.out, 1 << 16).writeLines(count);
+            case PARALLEL -> {
+                try (ParallelLineWriter writer = new ParallelLineWriter(System.out, threads)) {
+                    writer.writeLines(count);
+                }
+            }
         }
     }
 }
\ No newline at end of file
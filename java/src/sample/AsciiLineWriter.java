@@ -0,0 +1,70 @@
+package sample;
+
+import java.io.IOException;
+import java.io.OutputStream;
+import java.nio.charset.StandardCharsets;
+
+/**
+ * Writes the {@code "i = N"} lines as ASCII bytes formatted straight into a reused byte
+ * buffer. No {@code String} or other object is created per line; what the target stream
+ * does in its own {@code write} is up to the stream.
+ */
+public final class AsciiLineWriter {
+    private static final byte[] PREFIX = "i = ".getBytes(StandardCharsets.US_ASCII);
+    private static final byte[] NEWLINE = System.lineSeparator().getBytes(StandardCharsets.US_ASCII);
+    /** Longest line {@link #putLine} can produce: ten digits for {@code Integer.MAX_VALUE}. */
+    static final int MAX_LINE_BYTES = PREFIX.length + 10 + NEWLINE.length;
+
+    private final OutputStream out;
+    private final byte[] buffer;
+    private int length;
+
+    public AsciiLineWriter(OutputStream out, int bufferSize) {
+        if (bufferSize < MAX_LINE_BYTES) {
+            throw new IllegalArgumentException("bufferSize must be at least " + MAX_LINE_BYTES);
+        }
+        this.out = out;
+        this.buffer = new byte[bufferSize];
+    }
+
+    /** Writes {@code "i = 1"} .. {@code "i = count"} and flushes the underlying stream. */
+    public void writeLines(int count) throws IOException {
+        for (long i = 1; i <= count; i++) {
+            if (length > buffer.length - MAX_LINE_BYTES) {
+                drain();
+            }
+            length = putLine(buffer, length, (int) i);
+        }
+        drain();
+        out.flush();
+    }
+
+    private void drain() throws IOException {
+        out.write(buffer, 0, length);
+        length = 0;
+    }
+
+    /**
+     * Formats the line for {@code i >= 0} into {@code dst} at {@code pos} and returns the
+     * position just past it.
+     */
+    static int putLine(byte[] dst, int pos, int i) {
+        System.arraycopy(PREFIX, 0, dst, pos, PREFIX.length);
+        pos += PREFIX.length;
+        int end = pos + digits(i);
+        for (int p = end - 1; p >= pos; p--) {
+            dst[p] = (byte) ('0' + i % 10);
+            i /= 10;
+        }
+        System.arraycopy(NEWLINE, 0, dst, end, NEWLINE.length);
+        return end + NEWLINE.length;
+    }
+
+    private static int digits(int i) {
+        int digits = 1;
+        for (int limit = 10; digits < 10 && i >= limit; limit *= 10) {
+            digits++;
+        }
+        return digits;
+    }
+}
@@ -0,0 +1,43 @@
+package sample;
+
+import java.io.IOException;
+import java.io.PrintStream;
+import java.io.Writer;
+
+/**
+ * The loop from {@code Main}, pulled out so it can be benchmarked against any stream.
+ */
+public final class Lines {
+    /** Number of chars {@link #buffered} collects before handing them to the writer. */
+    static final int BATCH_CHARS = 8192;
+
+    private Lines() {
+    }
+
+    /** Prints {@code "i = 1"} .. {@code "i = count"}, one {@code println} per line. */
+    public static void println(PrintStream out, int count) {
+        // A long index, so that the loop still ends when count is Integer.MAX_VALUE.
+        for (long i = 1; i <= count; i++) {
+            out.println("i = " + i);
+        }
+    }
+
+    /**
+     * Prints the same lines as {@link #println}, but collects them in one reused
+     * {@link StringBuilder} and writes it out in {@value #BATCH_CHARS}-char batches,
+     * flushing once at the end.
+     */
+    public static void buffered(Writer out, int count) throws IOException {
+        String newline = System.lineSeparator();
+        StringBuilder batch = new StringBuilder(BATCH_CHARS + 32);
+        for (long i = 1; i <= count; i++) {
+            batch.append("i = ").append(i).append(newline);
+            if (batch.length() >= BATCH_CHARS) {
+                out.append(batch);
+                batch.setLength(0);
+            }
+        }
+        out.append(batch);
+        out.flush();
+    }
+}
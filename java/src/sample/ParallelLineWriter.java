@@ -0,0 +1,63 @@
+package sample;
+
+import java.io.IOException;
+import java.io.OutputStream;
+import java.util.concurrent.ForkJoinPool;
+import java.util.stream.IntStream;
+
+/**
+ * Writes the same bytes as {@link AsciiLineWriter}, but formats chunks of lines in parallel on
+ * a {@link ForkJoinPool} of its own (see "Parallel output" in the README). Close it to shut the
+ * pool down.
+ */
+public final class ParallelLineWriter implements AutoCloseable {
+    static final int CHUNK_LINES = 16 * 1024;
+    private static final int CHUNKS_PER_THREAD = 2;
+
+    private final OutputStream out;
+    private final ForkJoinPool pool;
+    private final byte[][] chunks;
+    private final int[] lengths;
+
+    public ParallelLineWriter(OutputStream out, int threads) {
+        if (threads < 1) {
+            throw new IllegalArgumentException("threads must be at least 1, got " + threads);
+        }
+        this.out = out;
+        this.pool = new ForkJoinPool(threads);
+        this.chunks = new byte[threads * CHUNKS_PER_THREAD][CHUNK_LINES * AsciiLineWriter.MAX_LINE_BYTES];
+        this.lengths = new int[chunks.length];
+    }
+
+    /** Writes {@code "i = 1"} .. {@code "i = count"} and flushes the underlying stream. */
+    public void writeLines(int count) throws IOException {
+        for (long waveStart = 1; waveStart <= count; waveStart += (long) chunks.length * CHUNK_LINES) {
+            int first = (int) waveStart;
+            int used = (int) Math.min(chunks.length, (count - waveStart) / CHUNK_LINES + 1);
+            // A parallel stream started from inside a ForkJoinPool runs on that pool.
+            pool.submit(() -> IntStream.range(0, used).parallel().forEach(c -> {
+                int from = first + c * CHUNK_LINES;
+                int to = (int) Math.min(count, (long) from + CHUNK_LINES - 1);
+                lengths[c] = formatChunk(chunks[c], from, to);
+            })).join();
+            for (int c = 0; c < used; c++) {
+                out.write(chunks[c], 0, lengths[c]);
+            }
+        }
+        out.flush();
+    }
+
+    private static int formatChunk(byte[] chunk, int from, int to) {
+        int length = 0;
+        // A long index, so that the loop still ends when to is Integer.MAX_VALUE.
+        for (long i = from; i <= to; i++) {
+            length = AsciiLineWriter.putLine(chunk, length, (int) i);
+        }
+        return length;
+    }
+
+    @Override
+    public void close() {
+        pool.shutdown();
+    }
+}
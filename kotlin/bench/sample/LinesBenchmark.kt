@@ -0,0 +1,62 @@
+package sample
+
+import kotlinx.benchmark.Benchmark
+import kotlinx.benchmark.Param
+import kotlinx.benchmark.Scope
+import kotlinx.benchmark.Setup
+import kotlinx.benchmark.State
+import kotlinx.benchmark.TearDown
+import java.io.FileOutputStream
+import java.io.PrintStream
+import java.io.Writer
+
+internal val NULL_DEVICE = if (System.getProperty("os.name").startsWith("Windows")) "NUL" else "/dev/null"
+
+/**
+ * kotlinx-benchmark suite for the `sample` loops. Throughput and latency run as two
+ * configurations in build.gradle.kts, because kotlinx-benchmark cannot sample single calls.
+ *
+ * [allocFree] creates its writer and buffer once per trial, so its loop is meant to allocate
+ * nothing. The `main` configuration (`gradle benchBenchmark`) runs with the `gc` profiler;
+ * check `gc.alloc.rate.norm` for [allocFree] in its report.
+ */
+@State(Scope.Benchmark)
+open class LinesBenchmark {
+    @Param("5", "1000000")
+    var count: Int = 0
+
+    private lateinit var out: PrintStream
+    private lateinit var writer: Writer
+    private lateinit var asciiOut: FileOutputStream
+    private lateinit var asciiWriter: AsciiLineWriter
+
+    @Setup
+    fun openSink() {
+        out = PrintStream(FileOutputStream(NULL_DEVICE), true)
+        writer = FileOutputStream(NULL_DEVICE).writer()
+        asciiOut = FileOutputStream(NULL_DEVICE)
+        asciiWriter = AsciiLineWriter(asciiOut, 1 shl 16)
+    }
+
+    @TearDown
+    fun closeSink() {
+        out.close()
+        writer.close()
+        asciiOut.close()
+    }
+
+    @Benchmark
+    fun println() {
+        printLines(out, count)
+    }
+
+    @Benchmark
+    fun buffered() {
+        writeLinesBuffered(writer, count)
+    }
+
+    @Benchmark
+    fun allocFree() {
+        asciiWriter.writeLines(count)
+    }
+}
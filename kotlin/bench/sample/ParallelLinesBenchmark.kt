@@ -0,0 +1,44 @@
+package sample
+
+import kotlinx.benchmark.Benchmark
+import kotlinx.benchmark.Param
+import kotlinx.benchmark.Scope
+import kotlinx.benchmark.Setup
+import kotlinx.benchmark.State
+import kotlinx.benchmark.TearDown
+import java.io.FileOutputStream
+
+/**
+ * kotlinx-benchmark suite for [ParallelLineWriter], for thread-scaling curves. Compare with
+ * `LinesBenchmark.allocFree`, its sequential counterpart.
+ *
+ * `threads` defaults to 1 and the `main` and `latency` configurations leave this class out.
+ * The `scaling` configuration sets `threads` to every count from 1 to the number of cores.
+ */
+@State(Scope.Benchmark)
+open class ParallelLinesBenchmark {
+    @Param("1000000")
+    var count: Int = 0
+
+    @Param("1")
+    var threads: Int = 0
+
+    private lateinit var out: FileOutputStream
+    private lateinit var writer: ParallelLineWriter
+
+    @Setup
+    fun openSink() {
+        out = FileOutputStream(NULL_DEVICE)
+        writer = ParallelLineWriter(out, threads)
+    }
+
+    @TearDown
+    fun closeSink() {
+        out.close()
+    }
+
+    @Benchmark
+    fun parallel() {
+        writer.writeLines(count)
+    }
+}
@@ -0,0 +1,107 @@
+plugins {
+    application
+    kotlin("jvm") version "1.9.24"
+    kotlin("plugin.allopen") version "1.9.24"
+    id("org.jetbrains.kotlinx.benchmark") version "0.4.11"
+    id("org.graalvm.buildtools.native") version "0.10.2"
+}
+
+repositories {
+    mavenCentral()
+}
+
+kotlin {
+    jvmToolchain(17)
+}
+
+application {
+    mainClass.set("MainKt")
+}
+
+// `gradle appCdsArchive`: records the classes loaded by one run of the installDist launcher into
+// build/cds/main.jsa. Launch with JAVA_OPTS=-XX:SharedArchiveFile=build/cds/main.jsa and the same
+// launcher, so the classpath matches the one the archive was dumped with.
+val appCdsArchive by tasks.registering(Exec::class) {
+    dependsOn(tasks.installDist)
+    val archive = layout.buildDirectory.file("cds/main.jsa")
+    outputs.file(archive)
+    executable = layout.buildDirectory.file("install/${project.name}/bin/${project.name}").get().asFile.path
+    environment("JAVA_OPTS", "-XX:ArchiveClassesAtExit=${archive.get().asFile}")
+    doFirst { archive.get().asFile.parentFile.mkdirs() }
+}
+
+// `gradle nativeCompile`: GraalVM native image at build/native/nativeCompile/kotlin-sample.
+graalvmNative {
+    binaries {
+        named("main") {
+            imageName.set(project.name)
+            mainClass.set("MainKt")
+        }
+    }
+}
+
+// The sample keeps the IntelliJ layout: sources in src/, kotlinx-benchmark suites in bench/.
+sourceSets {
+    main {
+        kotlin.srcDir("src")
+    }
+    create("bench") {
+        kotlin.srcDir("bench")
+        compileClasspath += sourceSets.main.get().output
+        runtimeClasspath += sourceSets.main.get().output
+    }
+}
+
+configurations["benchImplementation"].extendsFrom(configurations.implementation.get())
+
+dependencies {
+    implementation("org.jetbrains.kotlinx:kotlinx-coroutines-core:1.8.1")
+    "benchImplementation"("org.jetbrains.kotlinx:kotlinx-benchmark-runtime:0.4.11")
+}
+
+allOpen {
+    annotation("org.openjdk.jmh.annotations.State")
+}
+
+benchmark {
+    targets {
+        register("bench")
+    }
+    configurations {
+        // kotlinx-benchmark has no per-invocation sampling mode, so throughput and
+        // latency run as two configurations; bench/normalize.py merges them.
+        named("main") {
+            mode = "thrpt"
+            outputTimeUnit = "s"
+            warmups = 5
+            iterations = 5
+            iterationTime = 1
+            iterationTimeUnit = "s"
+            reportFormat = "json"
+            advanced("jvmProfiler", "gc")
+            exclude("ParallelLinesBenchmark")
+        }
+        // bench/scaling.sh: ParallelLinesBenchmark for every thread count from 1 to the number of cores.
+        register("scaling") {
+            include("ParallelLinesBenchmark")
+            mode = "thrpt"
+            outputTimeUnit = "s"
+            warmups = 5
+            iterations = 5
+            iterationTime = 1
+            iterationTimeUnit = "s"
+            reportFormat = "json"
+            param("threads", *(1..Runtime.getRuntime().availableProcessors()).map(Int::toString).toTypedArray())
+        }
+        register("latency") {
+            mode = "avgt"
+            outputTimeUnit = "ns"
+            warmups = 5
+            iterations = 20
+            iterationTime = 1
+            iterationTimeUnit = "s"
+            reportFormat = "json"
+            exclude("ParallelLinesBenchmark")
+        }
+    }
+}
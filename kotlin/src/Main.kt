@@ -1,14 +1,51 @@
+import sample.AsciiLineWriter
+import sample.ParallelLineWriter
+import sample.printLines
+import sample.writeLinesBuffered
+
+private enum class Output { PRINTLN, BUFFERED, ALLOC_FREE, PARALLEL }
+
+/**
+ * Options:
+ * - `--count N`: print `N` lines instead of 5.
+ * - `--buffered`: batch the lines and flush once instead of one `println` per line.
+ * - `--alloc-free`: like `--buffered`, but format the lines as bytes without allocating a
+ *   String per line.
+ * - `--parallel`: like `--alloc-free`, but format chunks of lines in coroutines on
+ *   `Dispatchers.Default` and write them in order.
+ * - `--threads N`: threads for `--parallel`, at least 1; defaults to the number of cores, which
+ *   is also the most `Dispatchers.Default` will use.
+ */
 //TIP To <b>Run</b> code, press <shortcut actionId="Run"/> or
 // click the <icon src="AllIcons.Actions.Execute"/> icon in the gutter.
-fun main() {
+fun main(args: Array<String>) {
+    var count = 5
+    var output = Output.PRINTLN
+    var threads = Runtime.getRuntime().availableProcessors()
+    var a = 0
+    while (a < args.size) {
+        when (args[a]) {
+            "--count" -> count = args[++a].toInt()
+            "--buffered" -> output = Output.BUFFERED
+            "--alloc-free" -> output = Output.ALLOC_FREE
+            "--parallel" -> output = Output.PARALLEL
+            "--threads" -> threads = args[++a].toInt()
+            else -> throw IllegalArgumentException("Unknown option: ${args[a]}")
+        }
+        a++
+    }
+
     val name = "Kotlin"
     //TIP Press <shortcut actionId="ShowIntentionActions"/> with your caret at the highlighted text
     // to see how IntelliJ IDEA suggests fixing it.
     println("Hello, " + name + "!")
 
-    for (i in 1..5) {
-        //TIP Press <shortcut actionId="Debug"/> to start debugging your code. We have set one <icon src="AllIcons.Debugger.Db_set_breakpoint"/> breakpoint
-        // for you, but you can always add more by pressing <shortcut actionId="ToggleLineBreakpoint"/>.
-        println("i = $i")
+    //TIP Press <shortcut actionId="Debug"/> to start debugging your code. We have set one <icon src="AllIcons.Debugger.Db_set_breakpoint"/> breakpoint
+    // for you, but you can always add more by pressing <shortcut actionId="ToggleLineBreakpoint"/>.
+    when (output) {
+        Output.PRINTLN -> printLines(System.out, count)
+        Output.BUFFERED -> writeLinesBuffered(System.out.writer(), count)
+        Output.ALLOC_FREE -> AsciiLineWriter(System.out, 1 shl 16).writeLines(count)
+        Output.PARALLEL -> ParallelLineWriter(System.out, threads).writeLines(count)
     }
 }
\ No newline at end of file
@@ -0,0 +1,65 @@
+package sample
+
+import java.io.OutputStream
+
+private val PREFIX = "i = ".toByteArray(Charsets.US_ASCII)
+private val NEWLINE = System.lineSeparator().toByteArray(Charsets.US_ASCII)
+
+/** Longest line [putLine] can produce: ten digits for `Int.MAX_VALUE`. */
+internal val MAX_LINE_BYTES = PREFIX.size + 10 + NEWLINE.size
+
+/**
+ * Writes the `"i = N"` lines as ASCII bytes formatted straight into a reused byte buffer.
+ * No `String` or other object is created per line; what the target stream does in its own
+ * `write` is up to the stream.
+ */
+class AsciiLineWriter(private val out: OutputStream, bufferSize: Int) {
+    private val buffer: ByteArray
+    private var length = 0
+
+    init {
+        require(bufferSize >= MAX_LINE_BYTES) { "bufferSize must be at least $MAX_LINE_BYTES" }
+        buffer = ByteArray(bufferSize)
+    }
+
+    /** Writes `"i = 1"` .. `"i = count"` and flushes the underlying stream. */
+    fun writeLines(count: Int) {
+        for (i in 1..count) {
+            if (length > buffer.size - MAX_LINE_BYTES) {
+                drain()
+            }
+            length = putLine(buffer, length, i)
+        }
+        drain()
+        out.flush()
+    }
+
+    private fun drain() {
+        out.write(buffer, 0, length)
+        length = 0
+    }
+}
+
+/** Formats the line for [i] >= 0 into [dst] at [pos] and returns the position just past it. */
+internal fun putLine(dst: ByteArray, pos: Int, i: Int): Int {
+    PREFIX.copyInto(dst, pos)
+    val start = pos + PREFIX.size
+    val end = start + digits(i)
+    var rest = i
+    for (p in end - 1 downTo start) {
+        dst[p] = ('0'.code + rest % 10).toByte()
+        rest /= 10
+    }
+    NEWLINE.copyInto(dst, end)
+    return end + NEWLINE.size
+}
+
+private fun digits(i: Int): Int {
+    var digits = 1
+    var limit = 10
+    while (digits < 10 && i >= limit) {
+        digits++
+        limit *= 10
+    }
+    return digits
+}
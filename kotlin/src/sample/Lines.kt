@@ -0,0 +1,32 @@
+package sample
+
+import java.io.PrintStream
+import java.io.Writer
+
+/** Number of chars [writeLinesBuffered] collects before handing them to the writer. */
+const val BATCH_CHARS = 8192
+
+/** Prints `"i = 1"` .. `"i = count"`, one `println` per line. This is the loop from `main`. */
+fun printLines(out: PrintStream, count: Int) {
+    for (i in 1..count) {
+        out.println("i = $i")
+    }
+}
+
+/**
+ * Prints the same lines as [printLines], but collects them in one reused [StringBuilder]
+ * and writes it out in [BATCH_CHARS]-char batches, flushing once at the end.
+ */
+fun writeLinesBuffered(out: Writer, count: Int) {
+    val newline = System.lineSeparator()
+    val batch = StringBuilder(BATCH_CHARS + 32)
+    for (i in 1..count) {
+        batch.append("i = ").append(i).append(newline)
+        if (batch.length >= BATCH_CHARS) {
+            out.append(batch)
+            batch.setLength(0)
+        }
+    }
+    out.append(batch)
+    out.flush()
+}
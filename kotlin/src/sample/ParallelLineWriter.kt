@@ -0,0 +1,58 @@
+package sample
+
+import kotlinx.coroutines.Dispatchers
+import kotlinx.coroutines.ExperimentalCoroutinesApi
+import kotlinx.coroutines.joinAll
+import kotlinx.coroutines.launch
+import kotlinx.coroutines.runBlocking
+import java.io.OutputStream
+
+const val CHUNK_LINES = 16 * 1024
+private const val CHUNKS_PER_THREAD = 2
+
+/**
+ * Writes the same bytes as [AsciiLineWriter], but formats chunks of lines in coroutines on
+ * [Dispatchers.Default] (see "Parallel output" in the README), at most [threads] at a time.
+ * `limitedParallelism` cannot go past the parallelism of [Dispatchers.Default] itself, so
+ * [threads] is capped at the number of cores, where the Java and C# writers run as many
+ * threads as they are given.
+ */
+class ParallelLineWriter(private val out: OutputStream, threads: Int) {
+    init {
+        require(threads >= 1) { "threads must be at least 1, got $threads" }
+    }
+
+    @OptIn(ExperimentalCoroutinesApi::class)
+    private val dispatcher = Dispatchers.Default.limitedParallelism(threads)
+    private val chunks = Array(threads * CHUNKS_PER_THREAD) { ByteArray(CHUNK_LINES * MAX_LINE_BYTES) }
+    private val lengths = IntArray(chunks.size)
+
+    /** Writes `"i = 1"` .. `"i = count"` and flushes the underlying stream. */
+    fun writeLines(count: Int) = runBlocking {
+        var waveStart = 1L
+        while (waveStart <= count) {
+            val first = waveStart.toInt()
+            val used = minOf(chunks.size.toLong(), (count - waveStart) / CHUNK_LINES + 1).toInt()
+            (0 until used).map { c ->
+                launch(dispatcher) {
+                    val from = first + c * CHUNK_LINES
+                    val to = minOf(count.toLong(), from.toLong() + CHUNK_LINES - 1).toInt()
+                    lengths[c] = formatChunk(chunks[c], from, to)
+                }
+            }.joinAll()
+            for (c in 0 until used) {
+                out.write(chunks[c], 0, lengths[c])
+            }
+            waveStart += chunks.size.toLong() * CHUNK_LINES
+        }
+        out.flush()
+    }
+}
+
+private fun formatChunk(chunk: ByteArray, from: Int, to: Int): Int {
+    var length = 0
+    for (i in from..to) {
+        length = putLine(chunk, length, i)
+    }
+    return length
+}